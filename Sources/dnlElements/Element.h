@@ -41,6 +41,7 @@ The type of element can be one of the following:
 class Element
 {
     friend class Node;
+    friend class NodalExtrapolation;
     friend class ListIndex<Element *>; // To be able to use ListIndex
     long _listIndex;                   // Local index used for the ListIndex management.
     Vec3D _nodeMin, _nodeMax;          // Bounding box of an element.
@@ -58,6 +59,7 @@ public:
     long number;
     Material *material = NULL;
     Matrix stiffnessMatrix;
+    double stableTimeStep = 0.0; // Stable time step of the element (Courant)
 
     enum // Enum defining the list of element names
     {
@@ -77,6 +79,13 @@ public:
         Threedimensional
     };
 
+    enum // Enum defining the list of kinematics used to compute the strain increments
+    {
+        LogarithmicStrain = 0,
+        HughesWinget,
+        Jaumann
+    };
+
 public:
     Element(long elementNumber = 1);
     Element(const Element &element);
@@ -88,6 +97,8 @@ public:
     friend std::ifstream &operator>>(std::ifstream &, Element &);
     void write(std::ofstream &) const;
     Element &read(std::ifstream &);
+    long computeTrialStress(ReturnMapping &returnMapping);
+    static void computePlasticCorrector(Material *material, ReturnMapping &returnMapping);
 #endif
 
     // Interface methods excluded from basic SWIG support
@@ -145,10 +156,10 @@ public:
     // void computeMomentumEquation(MatrixDiag &M, Vector &F);
     void computePressure();
     //  void computeStateEquationOld();
-    void computeStrains();
+    void computeStrains(short kinematics = LogarithmicStrain);
     //  void computeStrainsOld(double);
     void computeStress(double timeStep);
-    void computeStressDirect(double timeStep);
+    void computeStressDirect(double timeStep, double &internalWork, double &plasticWork);
     //  void computeStressOld(double timeStep);
     void createIntegrationPoints();
     void initializeData();
@@ -0,0 +1,98 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlFEM_AbaqusInterface_h__
+#define __dnlFEM_AbaqusInterface_h__
+
+#include <String.h>
+#include <List.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class NodeSet;
+class ElementSet;
+
+/*
+  \class AbaqusInterface
+  Streaming reader of the mesh of an Abaqus input file.
+
+  The *NODE, *ELEMENT, *NSET and *ELSET sections of an Abaqus .inp file are read line by line through a large file
+  buffer and the values are parsed in place, so that multi-million lines files are read at disk speed. The nodes and
+  elements are stored in arrays during the reading and transferred to the model at the end of the file through the bulk
+  creation methods of the DynELA class. The node and element sets are then created as NodeSet and ElementSet objects
+  of the model with the names of the Abaqus sets.
+
+  The sets defined inside a part are named PART.SET, and the sets defined at the assembly level keep their names, so that
+  a part set and an assembly set with the same name remain two different sets. As in Abaqus, the names are not case
+  sensitive, they are stored in uppercase.
+
+  The numbers of the nodes and elements are the ones of the input file. The sets defined at the assembly level with an
+  instance name refer to the same numbers, so that only models made of a single instance are supported.
+
+  \ingroup dnlFEM
+*/
+//-----------------------------------------------------------------------------
+// Class : AbaqusInterface
+//
+// Used to import the mesh of Abaqus input files
+//
+// This class is included in SWIG
+//-----------------------------------------------------------------------------
+class AbaqusInterface
+{
+#ifndef SWIG
+  // Elements of a given type read in the file
+  struct ElementBlock
+  {
+    short type;                     // DynELA type of the elements
+    int numberOfNodes;              // Number of nodes of the elements
+    std::vector<long> numbers;      // Numbers of the elements
+    std::vector<long> nodesNumbers; // Numbers of the nodes of the elements, stored element by element
+  };
+#endif
+
+private:
+#ifndef SWIG
+  std::vector<long> _nodesNumbers;                              // Numbers of the nodes read in the file
+  std::vector<double> _coords;                                  // Coordinates of the nodes read in the file
+  std::vector<ElementBlock> _elementBlocks;                     // Elements read in the file, one block per type
+  std::map<std::string, std::string> _instances;                // Parts of the instances read in the file
+  std::map<std::string, std::vector<long>> _nodeSetsNumbers;    // Numbers of the nodes of the sets read in the file
+  std::map<std::string, std::vector<long>> _elementSetsNumbers; // Numbers of the elements of the sets read in the file
+#endif
+  List<NodeSet *> _nodeSets;       // Node sets created in the model
+  List<ElementSet *> _elementSets; // Element sets created in the model
+
+public:
+  String name = "AbaqusInterface::_noname_"; // Name of the Abaqus interface
+
+  // constructeurs
+  AbaqusInterface(char *newName = NULL);
+  AbaqusInterface(const AbaqusInterface &);
+  ~AbaqusInterface();
+
+  // Interface methods excluded from SWIG
+#ifndef SWIG
+  ElementBlock &elementBlock(const char *abaqusType, long lineNumber);
+  void createMesh();
+  void readSetValues(char *pointer, char *end, std::map<std::string, std::vector<long>> &sets, std::vector<long> &values, bool generate, const std::string &scope);
+#endif
+
+  // Interface methods excluded from basic SWIG support
+#if !defined(SWIG) || defined(CSWIG)
+#endif
+
+  ElementSet *getElementSet(String setName);
+  NodeSet *getNodeSet(String setName);
+  void readFile(String fileName);
+};
+
+#endif
@@ -68,6 +68,11 @@ public:
   // Interface methods excluded from SWIG
 #ifndef SWIG
   LogFile logFile; // Log file
+
+  bool createElements(short type, long numberOfElements, const long *elementsNumbers, const long *nodesNumbers);
+  bool createNodes(long numberOfNodes, const long *nodesNumbers, const double *coords);
+  Element *newElement(short type, long elementNumber);
+  void emergencyExit();
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -102,6 +107,8 @@ public:
   void scale(double scaleValue, NodeSet *nodeSet = NULL);
   void scale(Vec3D scaleVector, NodeSet *nodeSet = NULL);
   void setDefaultElement(short type);
+  void setKinematics(char *method);
+  void setReturnMappingPredictor(bool predictor);
   void setSaveTimes(double startSaveTime, double endSaveTime, double saveTimeIncrement);
   void solve();
   void setStressComputation(char *method);
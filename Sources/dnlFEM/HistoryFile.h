@@ -13,6 +13,7 @@
 
 #include <List.h>
 #include <String.h>
+#include <vector>
 class Element;
 class ElementSet;
 class Model;
@@ -131,9 +132,13 @@ private:
   FILE *_pfile;
   List<HistoryFileItem *> _items;
   String _fileName;
+  std::vector<double> _buffer; // Rows of the history waiting to be written, the current time followed by the items
+  long _writtenRows = 0;       // Number of rows already written in the binary file
 
 public:
   String name = "HistoryFile::_noname_";
+  bool binary = false;  // Write the history as a numpy structured array in a .npy file
+  int bufferSize = 100; // Number of rows kept in memory before being written to the file
 
 public:
   // constructor
@@ -144,6 +149,7 @@ public:
   // Interface methods excluded from SWIG
 #ifndef SWIG
   void close();
+  void flush();
   void headerWrite();
   void open();
   void save(double currentTime);
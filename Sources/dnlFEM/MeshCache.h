@@ -0,0 +1,79 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlFEM_MeshCache_h__
+#define __dnlFEM_MeshCache_h__
+
+#include <String.h>
+#include <vector>
+
+class NodeSet;
+class ElementSet;
+
+/*
+  \class MeshCache
+  Binary cache of the mesh of a model.
+
+  The nodes, the elements, the node and element sets and the attachment of the materials to the element sets of the model
+  are saved in a compact binary file after the first construction of the model. On the following runs, the file is mapped
+  in memory and the arrays of the file are given directly to the bulk creation methods of the DynELA class, so that the
+  model is rebuilt without the Python calls and the searches of the construction of the mesh. The file stores a checksum
+  of the source script of the model and of each file read by the script to build the mesh, such as an Abaqus input file,
+  the cache is only used if none of them has been modified since it was written, and a checksum of its own data to
+  detect a truncated or corrupted file. The values are stored in the native binary
+  format of the computer.
+
+  \ingroup dnlFEM
+*/
+//-----------------------------------------------------------------------------
+// Class : MeshCache
+//
+// Used to save and reload the mesh of a model in a binary file
+//
+// This class is included in SWIG
+//-----------------------------------------------------------------------------
+class MeshCache
+{
+private:
+  const char *_cursor = NULL; // Current position in the mapped file
+  const char *_end = NULL;    // End of the mapped file
+#ifndef SWIG
+  std::vector<char> _data; // Data of the file to write
+#endif
+
+public:
+  String name = "MeshCache::_noname_"; // Name of the mesh cache
+
+  // constructeurs
+  MeshCache(char *newName = NULL);
+  MeshCache(const MeshCache &);
+  ~MeshCache();
+
+  // Interface methods excluded from SWIG
+#ifndef SWIG
+  const char *readArray(long size);
+  long readLong();
+  String readString();
+  void writeArray(const void *values, long size);
+  void writeLong(long value);
+  void writeString(const String &value);
+  bool load(String fileName, String sourceFileName, const std::vector<String> &inputFiles = std::vector<String>());
+  void save(String fileName, String sourceFileName, const std::vector<String> &inputFiles = std::vector<String>());
+#endif
+
+  // Interface methods excluded from basic SWIG support
+#if !defined(SWIG) || defined(CSWIG)
+#endif
+
+  ElementSet *getElementSet(String setName);
+  NodeSet *getNodeSet(String setName);
+};
+
+#endif
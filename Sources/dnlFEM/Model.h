@@ -13,6 +13,9 @@
 
 #include <MatrixDiag.h>
 #include <Vector.h>
+#include <ReturnMappingStatistics.h>
+#include <NodalExtrapolation.h>
+#include <ModelState.h>
 
 class DynELA;
 class Element;
@@ -20,8 +23,10 @@ class ElementSet;
 class HistoryFile;
 class Node;
 class NodeSet;
+class ReturnMapping;
 class Solver;
 class Material;
+class VumatBlock;
 
 //-----------------------------------------------------------------------------
 // Class : class Model
@@ -39,7 +44,8 @@ private:
   enum
   {
     StressIntNR = 0,
-    StressIntDirect
+    StressIntDirect,
+    StressIntVumat
   };
 #endif
   bool _massMatrixComputed = false;        // Flag defining that the mass matrix has already been computed
@@ -49,11 +55,24 @@ private:
   short _numberOfDimensions = 0;           // Number of dimensions of the model
   Vector _powerIterationEV;
   bool _initSolveDone = false;
+  double _initialEnergy = 0.0;          // Total energy of the model at the beginning of the computation
+  bool _returnMappingPredictor = false; // Use the linearized hardening predictor for the initial value of gamma
   int _stressIntegrationMethod = StressIntNR;
+  short _kinematics = 0;                 // Kinematics used to compute the strain increments, defined in Element
+  List<ReturnMapping *> _returnMappings; // Blocks of plastic integration points, one per material
+  List<VumatBlock *> _vumatBlocks;       // Blocks of integration points for the VUMAT interface, one per material
+#ifndef SWIG
+  ReturnMappingStatistics _returnMappingStatistics; // Convergence statistics of the radial return
+#endif
 
 public:
   double currentTime = 0.0;         // Temps actuel du modele
+  double externalWork = 0.0;        // Work of the reactions of the boundary conditions, accumulated along the increments
+  double internalWork = 0.0;        // Internal energy of the model, accumulated along the increments
+  double kineticEnergy = 0.0;       // Kinetic energy of the model at the end of the last increment
   double nextTime = 0.0;            // Temps actuel du modele + increment de temps
+  double plasticFraction = 0.0;     // Fraction of integration points corrected by the radial return during the last increment
+  double plasticWork = 0.0;         // Plastic work dissipated by the model, accumulated along the increments
   List<ElementSet *> elementsSets;  // List of the Elements Sets
   List<HistoryFile *> historyFiles; // List of the History Files
   List<Material *> materials;       // Materials list of the structure
@@ -64,10 +83,16 @@ public:
   Solver *solver = NULL;            // solveurs associes au modele
   String name = "Model::_noname_";  // Name of the model
   Vector internalForces;            // Vecteur des forces internes
+#ifndef SWIG
+  NodalExtrapolation nodalExtrapolation; // Cache of the integration point fields extrapolated to the nodes
+  ModelState state;                      // Contiguous arrays of the state of the model for the Python interface
+#endif
 
 private:
   bool add(Element *pel);
   bool add(Node *pnd);
+  void add(const std::vector<Element *> &newElements);
+  void add(const std::vector<Node *> &newNodes);
   void add(ElementSet *elementSet, long startNumber = -1, long endNumber = -1, long increment = 1);
   void add(HistoryFile *newHistoryFile);
   void add(NodeSet *nodeSet, long startNumber = -1, long endNumber = -1, long increment = 1);
@@ -81,6 +106,8 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  void create(const std::vector<Element *> &newElements, const long *listOfNodesNumbers);
+  void writeReturnMappingReport(std::ostream &os);
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -93,6 +120,7 @@ public:
   double computeCourantTimeStep();
   double computePowerIterationTimeStep(bool underIntegration = false);
   double getEndSolveTime();
+  double getEnergyBalance();
   double getTotalKineticEnergy();
   double getTotalMass();
   Element *getElementByNum(long elementNumber);
@@ -109,7 +137,10 @@ public:
   void computeStress(double timeStep);
   void create(Element *pel, long *listOfNodesNumber);
   void transfertQuantities();
+  void flushHistoryFiles();
+  void initEnergies();
   void writeHistoryFiles();
+  void writeTimeStepReport(int numberOfElements, int numberOfBins = 10);
 
   /*
   // gestion du temps
@@ -0,0 +1,61 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlFEM_ModelState_h__
+#define __dnlFEM_ModelState_h__
+
+class Model;
+
+/*
+  \class ModelState
+  Contiguous arrays of the state of the model for the Python interface.
+
+  The nodal quantities of the model are stored in the Node objects, so that they cannot be seen as arrays from Python.
+  This class gathers a nodal quantity, or the mean value of an integration point field over each element, in a single
+  parallel sweep into an array given by the caller. The Python interface allocates a bytes object of the right size
+  and gathers the values directly into its memory, so that the read-only NumPy array built on it is obtained with a
+  single pass over the model and without any formatting or intermediate copy. The NumPy array owns its memory through
+  the bytes object, so that it stays valid when the model is resized or destroyed.
+
+  \ingroup dnlFEM
+*/
+//-----------------------------------------------------------------------------
+// Class : ModelState
+//
+// Used to manage the contiguous arrays of the state of the model for the Python interface
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#if !defined(SWIG)
+class ModelState
+{
+public:
+  // Nodal quantities
+  enum
+  {
+    coordinates = 0,
+    displacements,
+    speeds,
+    accelerations,
+    masses,
+    numberOfQuantities
+  };
+
+public:
+  ModelState();
+  ~ModelState();
+
+  static int components(short quantity);
+  void elementValues(Model &model, short field, double *values);
+  void nodalValues(Model &model, short quantity, double *values);
+};
+#endif
+
+#endif
@@ -0,0 +1,75 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlFEM_NodalExtrapolation_h__
+#define __dnlFEM_NodalExtrapolation_h__
+
+#include <dnlMaths.h>
+#include <List.h>
+#include <vector>
+
+class IntegrationPoint;
+class Model;
+class Node;
+
+/*
+  \class NodalExtrapolation
+  Cache of the integration point fields extrapolated to the nodes.
+
+  Node::fieldScalar() and Node::fieldSymTensor2() extrapolate the integration point values of the elements of a node
+  at each call, so that writing a result file loops once over the elements of each node for each field and each
+  component. This class extrapolates all the requested fields in a single parallel sweep over the elements: the values
+  of the integration points of each element are multiplied by precomputed weights (the extrapolation matrix of the
+  element divided by the number of elements of the node) and scattered to the nodes. The nodal values are then read from
+  the cache until the next call to compute(), the fields not in the cache are read from the nodes.
+
+  \ingroup dnlFEM
+*/
+//-----------------------------------------------------------------------------
+// Class : NodalExtrapolation
+//
+// Used to manage the cache of the integration point fields extrapolated to the nodes
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#if !defined(SWIG)
+class NodalExtrapolation
+{
+private:
+  long _numberOfNodes = -1;          // Number of nodes of the precomputed weights
+  long _numberOfElements = -1;       // Number of elements of the precomputed weights
+  int _components = 0;               // Number of values stored per node
+  std::vector<long> _nodeOffsets;    // Offsets of the nodes of each element in _nodeIndexes
+  std::vector<long> _nodeIndexes;    // Indexes of the nodes of the elements
+  std::vector<long> _weightOffsets;  // Offsets of the weights of each element in _weights
+  std::vector<double> _weights;      // Extrapolation weights of the elements, one row per node of the element
+  std::vector<short> _quantities;    // Extrapolated integration point quantities
+  std::vector<int> _quantityOffsets; // Offsets of each quantity in the values of a node, -1 if not extrapolated
+  std::vector<double> _values;       // Nodal values of the extrapolated quantities
+
+public:
+  NodalExtrapolation();
+  ~NodalExtrapolation();
+
+  bool contains(short field) const;
+  double fieldScalar(Node *node, short field);
+  SymTensor2 fieldSymTensor2(Node *node, short field);
+  void clear();
+  void compute(Model &model, List<short> &fields);
+
+private:
+  static int quantityComponents(short quantity);
+  static short quantityOf(short field);
+  static void quantityValues(const IntegrationPoint *intPoint, short quantity, double *values);
+  void computeWeights(Model &model);
+};
+#endif
+
+#endif
@@ -30,6 +30,10 @@ protected:
   double _timeStepSafetyFactor = 0.9;
   int _computeTimeStepFrequency = 10;
   int _reportFrequency = 100;
+  int _timeStepReportBins = 10;
+  int _timeStepReportElements = 0;
+  int _timeStepReportFrequency = 100;
+  long _timeStepComputations = 0;
   short _timeStepMethod = Courant;
 
 public:
@@ -75,6 +79,7 @@ public:
   void setModel(Model *newModel);
   void setTimes(double start_time, double end_time);
   void setTimeStepMethod(short method);
+  void setTimeStepReport(int numberOfElements, int numberOfBins = 10, int frequency = 100);
   void setTimeStepSafetyFactor(double safetyfactor);
 
   // TrashBin here after
@@ -15,6 +15,61 @@
 #include <List.h>
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <string>
+#include <utility>
+#ifndef SWIG
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+/*
+  \class VtkSnapshot
+  Copy of the results of the model to write in a VTK file.
+
+  The coordinates of the nodes, the topology and the requested nodal and element fields are copied from the model at
+  save time, so that the file can be formatted and written later by the writer thread of the VtkInterface while the
+  solver continues the computation.
+
+  \ingroup dnlFEM
+*/
+//-----------------------------------------------------------------------------
+// Class : VtkSnapshot
+//
+// Used to manage a copy of the results of the model to write in a VTK file
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#ifndef SWIG
+class VtkSnapshot
+{
+public:
+  // Field of the snapshot
+  struct Array
+  {
+    String name;                // VTK name of the field
+    short type;                 // Type of the field (0: scalar, 1: vector, 2: tensor)
+    int components;             // Number of components of the field
+    std::vector<double> values; // Values of the field
+  };
+
+public:
+  String fileName;              // Name of the result file
+  String pvdFileName;           // Name of the ParaView collection file, empty for a legacy VTK file
+  String title;                 // Title of the result file
+  bool binary = false;          // Legacy VTK file in binary format
+  double time = 0.0;            // Time of the snapshot
+  long numberOfNodes = 0;       // Number of nodes
+  long numberOfElements = 0;    // Number of elements
+  std::vector<double> points;   // Coordinates of the nodes
+  std::vector<int> cells;       // Number of nodes followed by the indexes of the nodes of each element
+  std::vector<int> types;       // VTK types of the elements
+  std::vector<Array> pointData; // Nodal fields
+  std::vector<Array> cellData;  // Element fields
+};
+#endif
 
 //-----------------------------------------------------------------------------
 // Class : VtkInterface
@@ -27,11 +82,31 @@ class VtkInterface
 {
 private:
   List<short> _outputFields;
+  List<short> _outputCellFields;
   std::ofstream _stream;
   String _fileName;
+  std::vector<float> _floatBuffer; // Buffer of the float arrays written in binary format
+  std::vector<int> _intBuffer;     // Buffer of the integer arrays written in binary format
+  std::string _vtuTopology;        // Compressed Cells section of the vtu files, encoded once for all the time series
+  long _vtuTopologyElements = -1;  // Number of elements of the encoded Cells section
+  std::vector<std::pair<double, std::string>> _pvdFiles; // Times and names of the vtu files of the time series
+#ifndef SWIG
+  VtkSnapshot _snapshots[2];                // Double buffer of snapshots
+  std::deque<VtkSnapshot *> _freeSnapshots;  // Snapshots available for the solver
+  std::deque<VtkSnapshot *> _readySnapshots; // Snapshots waiting for the writer thread
+  std::thread _writer;                      // Writer thread
+  std::mutex _mutex;                        // Protects the lists of snapshots
+  std::condition_variable _condition;       // Signals the changes of the lists of snapshots
+  bool _stopWriter = false;                 // Stop request for the writer thread
+  long _asynchronousFiles = 0;              // Number of files written by the writer thread
+  double _waitTime = 0.0;                   // Time spent by the solver waiting for a free snapshot
+#endif
 
 public:
   String name = "VtkInterface::_noname_"; // Name of the VTK interface
+  bool asynchronous = false;              // Write the result files on a background thread during the solve
+  bool binary = false;                    // Write the VTK files in the legacy binary format (big-endian)
+  bool timeSeries = false;                // Write the results as a ParaView time series of compressed vtu files
 
   // constructeurs
   VtkInterface(char * = NULL);
@@ -40,11 +115,23 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
-  void headerWrite();
-  void nodesWrite();
+  void binaryWrite(std::vector<float> &values);
+  void binaryWrite(std::vector<int> &values);
+  void capture(VtkSnapshot &snapshot, String fileName, String pvdFileName);
+  void floatGather(const std::vector<double> &values);
+  void headerWrite(const VtkSnapshot &snapshot);
+  void nodesWrite(const VtkSnapshot &snapshot);
   void nodesNumbersWrite();
-  void elementsWrite();
-  void dataWrite();
+  void elementsWrite(const VtkSnapshot &snapshot);
+  void dataWrite(const VtkSnapshot &snapshot);
+  void cellDataWrite(const VtkSnapshot &snapshot);
+  void snapshotWrite(VtkSnapshot &snapshot);
+  void vtuDataArray(const char *type, String name, int components, const void *data, size_t size);
+  std::string vtuEncode(const void *data, size_t size);
+  void vtuTopologyEncode(const VtkSnapshot &snapshot);
+  void vtuWrite(const VtkSnapshot &snapshot);
+  void writePvd(String pvdFileName, String vtuFileName, double time);
+  void writerLoop();
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -54,11 +141,15 @@ public:
   int getNumberOfFields();
   short existField(short);
   void addField(short);
+  void addCellField(short);
   void close();
   void openFile(String);
   void initFields();
   void removeField(short);
+  void startAsynchronousWrite();
+  void stopAsynchronousWrite();
   void write();
+  void writeFile(String fileName, String pvdFileName = "");
 };
 
 #endif
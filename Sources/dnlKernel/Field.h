@@ -51,19 +51,27 @@ public:
     FIELD_VEC3D(dispInc),            // -> NodalField : Increment of the disp
     FIELD_VEC3D(speed),              // -> NodalField : Speed of a node
     FIELD_VEC3D(speedInc),           // -> NodalField : Increment of the speed of a node
+    bissections,                     // ->INT PT : Number of bissection steps of the last radial return
     density,                         // ->INT PT : Material density
     //energy,                          // Total energy
     //energyInc,                       // Increment of the total energy
+    energyBalance,                   // -> GLOBAL : Energy balance error of the current model
+    externalWork,                    // -> GLOBAL : Work of the reactions of the boundary conditions
     gamma,                           // ->INT PT : Gamma radial return value
     gammaCumulate,                   // ->INT PT : Cumulative value of gamma values
     internalEnergy,                  // ->INT PT : Internal energy
     inelasticEnergy,                 // ->INT PT : Inelastic energy
+    internalWork,                    // -> GLOBAL : Internal energy of the current model
+    iterations,                      // ->INT PT : Number of iterations of the last radial return
     kineticEnergy,                   // -> GLOBAL : Kinetic energy of the current model
     mass,                            // -> NODE : Nodal Mass
+    plasticFraction,                 // -> GLOBAL : Fraction of plastic integration points during the last increment
     plasticStrain,                   // ->INT PT : Equivalent plastic strain
     plasticStrainRate,               // ->INT PT : Equivalent plastic strain rate
+    plasticWork,                     // -> GLOBAL : Plastic work dissipated by the current model
     pressure,                        // ->INT PT : Pressure
     realTimeStep,                    // -> GLOBAL : Real timeStep taking into account the reducing due to saves
+    stableTimeStep,                  // -> ELEMENT : Stable time step of the element
     T,                               // ->INT PT : Temperature
     //T0,                              // Initial Temperature
     timeStep,                        // -> GLOBAL : TimeStep
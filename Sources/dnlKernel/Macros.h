@@ -82,5 +82,6 @@ struct Tensor2Index
  * Standard mathematical defines functions
  */
 #define precisionPolarDecompose 10.0E-10
+#define precisionPolarSeries 1.0E-14
 
 #endif
@@ -12,6 +12,7 @@
 #define __dnlMaterials_ANN2SigLaw_h__
 
 #include <HardeningLaw.h>
+#include <vector>
 
 /*
   \class ANN2SigLaw
@@ -58,9 +59,17 @@ class ANN2SigLaw : public HardeningLaw
   // double T0 = 0.0;
   // double Tm = 0.0;
   double dummy;
-  Matrix w1, w2, w3;
-  Vector b1, b2, b3;
-  Vector logBase, minEntries, maxEntries, rangeEntries;
+  int _neurons1 = 0;                              // Number of neurons of the first hidden layer
+  int _neurons2 = 0;                              // Number of neurons of the second hidden layer
+  std::vector<double> _weights1;                  // Weights of the first hidden layer stored as 3 rows of _neurons1 values
+  std::vector<double> _weights2;                  // Weights of the second hidden layer stored as _neurons1 rows of _neurons2 values
+  std::vector<double> _weights3;                  // Weights of the output layer
+  std::vector<double> _bias1;                     // Bias of the first hidden layer
+  std::vector<double> _bias2;                     // Bias of the second hidden layer
+  double _bias3 = 0.0;                            // Bias of the output layer
+  double _logBase = 1.0;                          // Reference plastic strain rate
+  double _minEntries[4] = {0.0, 0.0, 0.0, 0.0};   // Minimum values of the inputs and of the output used for the normalization
+  double _rangeEntries[4] = {1.0, 1.0, 1.0, 1.0}; // Ranges of the inputs and of the output used for the normalization
 
 public:
   ANN2SigLaw();
@@ -69,6 +78,11 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL);
+  double computeNetwork(double *derivatives, const double *input);
+  void computeNetwork(long count, double *outputs, double *derivatives, const double *inputs);
+  void computeReturnMapping(ReturnMapping &returnMapping);
+  void getBlockYieldStressAndDerivative(long count, double *yieldStress, double *hardening, const double *plasticStrain, const double *plasticStrainRate, const double *T, double dtime);
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -69,6 +69,7 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL);
 #endif
 
   // Interface methods excluded from basic SWIG support
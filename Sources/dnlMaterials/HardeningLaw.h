@@ -14,6 +14,9 @@
 #include <dnlMaths.h>
 
 class ElementSet;
+class LogFile;
+class ReturnMapping;
+class VumatBlock;
 
 class IntegrationPoint;
 class Element;
@@ -39,7 +42,9 @@ public:
     Tabular,
     JohnsonCook,
     ANN2Sig,
-    ANNFortran
+    ANNFortran,
+    Tabulated,
+    ANNGenerated
   };
 #endif
 
@@ -57,6 +62,11 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  virtual double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL) = 0;
+  virtual void computeReturnMapping(ReturnMapping &returnMapping);
+  virtual void computeVumat(VumatBlock &block);
+  virtual void getBlockYieldStressAndDerivative(long count, double *yieldStress, double *hardening, const double *plasticStrain, const double *plasticStrainRate, const double *T, double dtime);
+  virtual void initSolve(LogFile &logFile);
 #endif
 
   // Interface methods excluded from basic SWIG support
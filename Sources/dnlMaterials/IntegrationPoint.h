@@ -74,9 +74,13 @@ public:
   double pressure = 0;          // partie spherique du tenseur des contraintes
   double gamma = 0;             // state variable for VUMAT gamma
   double gammaCumulate = 0;     // state variable for VUMAT gamma
+  double hardening = 0;         // Hardening coefficient at the end of the last radial return
+  int iterations = 0;           // Number of iterations of the last radial return
+  int bissections = 0;          // Number of bissection steps of the last radial return
   double T = 0;                 // state variable for VUMAT T
   double internalEnergy = 0;    //
   double inelasticEnergy = 0;   //
+  double mass = 0;              // Mass of the material attached to the integration point
   double density;               //
   SymTensor2 Strain;            // tenseur des deformations
   SymTensor2 StrainInc;         // increment du tenseur des deformations
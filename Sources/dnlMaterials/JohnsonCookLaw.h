@@ -65,6 +65,11 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL);
+  void computeReturnMapping(ReturnMapping &returnMapping);
+#ifdef __AVX2__
+  void computeReturnMapping4(ReturnMapping &returnMapping, long first, int count);
+#endif
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -26,6 +26,7 @@ class HardeningLaw;
 class Material
 {
   friend class DynELA;
+  friend class MeshCache;
 
 public:
 #ifndef SWIG
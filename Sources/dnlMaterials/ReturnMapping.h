@@ -0,0 +1,103 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlMaterials_ReturnMapping_h__
+#define __dnlMaterials_ReturnMapping_h__
+
+#include <dnlMaths.h>
+#include <vector>
+
+class HardeningLaw;
+class IntegrationPoint;
+
+/*
+  \class ReturnMapping
+  Block of integration points for the radial return algorithm.
+
+  The plastic integration points sharing the same material are gathered in this structure of arrays,
+  so that the hardening law can solve the radial return equation for all of them at once:
+  \f[ f(\Gamma)=\sqrt{\frac{3}{2}}\left\Vert s^{trial}\right\Vert -\sqrt{\frac{3}{2}}2G\Gamma-\sigma^{y}(\overline{\varepsilon^{p}},\stackrel{\bullet}{\overline{\varepsilon^{p}}},T)=0 \f]
+  On input, gamma contains the initial value, yieldStress the current yield stress and hardening the hardening coefficient
+  at the end of the previous increment of the points. On output, gamma, yieldStress and hardening contain the converged values,
+  and iterations and bissections the cost of the Newton-Raphson procedure for each point.
+
+  When the predictor is enabled, the initial value of gamma is replaced by the solution of the radial return equation
+  linearized around the previous increment:
+  \f[ \Gamma_{0}=\frac{\sqrt{\frac{3}{2}}\left\Vert s^{trial}\right\Vert -\sigma^{y}+\sqrt{\frac{2}{3}}h\Gamma_{n}}{\sqrt{\frac{3}{2}}2G+\sqrt{\frac{2}{3}}h} \f]
+
+  \ingroup dnlMaterials
+*/
+//-----------------------------------------------------------------------------
+// Class : ReturnMapping
+//
+// Used to manage a block of integration points for the radial return
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#if !defined(SWIG)
+class ReturnMapping
+{
+public:
+  bool predictor = false;        // Use the linearized hardening predictor for the initial value of gamma
+  double heatFraction = 0.0;     // Taylor-Quinney coefficient divided by density and heat capacity
+  double internalWork = 0.0;     // Internal work of the points of the material during the increment
+  double plasticWork = 0.0;      // Plastic work of the points of the material during the increment
+  double timeStep = 0.0;         // Current time step
+  double tolerance = 1e-8;       // Tolerance of the Newton-Raphson procedure
+  double twoShearModulus = 0.0;  // Two times the shear modulus of the material
+  int maxIterations = 250;       // Maximum number of iterations of the Newton-Raphson procedure
+  std::vector<IntegrationPoint *> integrationPoints; // Integration points of the block
+  std::vector<SymTensor2> deviatoricStress;         // Trial deviatoric stress
+  std::vector<double> gamma;                        // Consistency parameter of the radial return
+  std::vector<double> hardening;                    // Hardening coefficient of the material
+  std::vector<double> plasticStrain0;               // Plastic strain at the beginning of the increment
+  std::vector<double> Snorm;                        // Norm of the trial deviatoric stress
+  std::vector<double> Snorm0;                       // Norm of the deviatoric stress at the beginning of the increment
+  std::vector<double> Strial;                       // Trial von Mises equivalent stress
+  std::vector<double> T0;                           // Temperature at the beginning of the increment
+  std::vector<double> yieldStress;                  // Yield stress of the material
+  std::vector<int> bissections;                     // Number of bissection steps
+  std::vector<int> iterations;                      // Number of iterations
+
+private:
+  std::vector<long> _active;               // Points of the block still iterating in solveBlock()
+  std::vector<double> _blockHardening;     // Hardening coefficients of the active points
+  std::vector<double> _blockPlasticStrain; // Plastic strains of the active points
+  std::vector<double> _blockRate;          // Plastic strain rates of the active points
+  std::vector<double> _blockT;             // Temperatures of the active points
+  std::vector<double> _blockYieldStress;   // Yield stresses of the active points
+  std::vector<double> _gammaMax;           // Upper bounds of gamma
+  std::vector<double> _gammaMin;           // Lower bounds of gamma
+
+public:
+  ReturnMapping();
+  ~ReturnMapping();
+
+  long add(IntegrationPoint *intPoint, const SymTensor2 &DeviatoricStress, double Snorm, double Snorm0, double gamma);
+  long add(IntegrationPoint *intPoint, const SymTensor2 &DeviatoricStress, double Snorm, double Snorm0, double gamma, double plasticStrain0, double T0, double yieldStress, double hardening);
+  long size() const;
+  void clear();
+  void predict();
+  void noConvergence(long point, double gamma, double gammaMin, double gammaMax, double dgamma, double fun, double plasticStrain, double plasticStrainRate, double T);
+  void setParameters(double twoShearModulus, double heatFraction, double timeStep);
+  void solve(HardeningLaw *hardeningLaw);
+  void solveBlock(HardeningLaw *hardeningLaw);
+  void solvePoint(HardeningLaw *hardeningLaw, long point);
+};
+
+//-----------------------------------------------------------------------------
+inline long ReturnMapping::size() const
+//-----------------------------------------------------------------------------
+{
+  return gamma.size();
+}
+#endif
+
+#endif
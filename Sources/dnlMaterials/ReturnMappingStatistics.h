@@ -0,0 +1,81 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlMaterials_ReturnMappingStatistics_h__
+#define __dnlMaterials_ReturnMappingStatistics_h__
+
+#include <ReturnMapping.h>
+
+/*
+  \class ReturnMappingStatistics
+  Convergence statistics of the radial return algorithm.
+
+  The blocks of plastic integration points are added once solved, and the statistics are cumulated over the whole
+  computation: histogram of the number of Newton-Raphson iterations, number of bissection steps and list of the
+  points having required the largest number of iterations.
+
+  \ingroup dnlMaterials
+*/
+//-----------------------------------------------------------------------------
+// Class : ReturnMappingStatistics
+//
+// Used to manage the convergence statistics of the radial return
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#if !defined(SWIG)
+class ReturnMappingStatistics
+{
+public:
+  // Point having required a large number of iterations
+  struct WorstPoint
+  {
+    IntegrationPoint *intPoint; // Integration point
+    long element;               // Number of the element, set by the owner of the integration points
+    short intPointId;           // Index of the integration point in the element, set by the owner
+    long increment;             // Increment number
+    double time;                // Current time
+    int iterations;             // Number of iterations
+    int bissections;            // Number of bissection steps
+    double Strial;              // Trial von Mises equivalent stress
+    double yieldStress;         // Converged yield stress
+    double plasticStrain;       // Plastic strain at the beginning of the increment
+    double T;                   // Temperature at the beginning of the increment
+  };
+
+  static const int numberOfBins = 16; // Number of bins of the histogram of iterations, the last one cumulates the larger values
+
+public:
+  int numberOfWorstPoints = 10;       // Number of worst points kept
+  int maxIterations = 0;              // Maximum number of iterations
+  long bissections = 0;               // Total number of bissection steps
+  long bissectedPoints = 0;           // Number of points having required bissection steps
+  long increments = 0;                // Number of increments
+  long iterations = 0;                // Total number of iterations
+  long points = 0;                    // Total number of plastic points
+  long maxPoints = 0;                 // Maximum number of plastic points in an increment
+  long histogram[numberOfBins] = {0}; // Histogram of the number of iterations
+  std::vector<WorstPoint> worstPoints; // Points having required the largest number of iterations
+
+private:
+  long _incrementPoints = 0; // Number of plastic points of the current increment
+
+public:
+  ReturnMappingStatistics();
+  ~ReturnMappingStatistics();
+
+  void add(const ReturnMapping &returnMapping, double time);
+  void clear();
+  void nextIncrement();
+  void write(std::ostream &os) const;
+};
+#endif
+
+#endif
@@ -32,6 +32,8 @@ public:
 
   // Interface methods excluded from SWIG
 #ifndef SWIG
+  double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL);
+  void initSolve(LogFile &logFile);
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -0,0 +1,108 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlMaterials_TabulatedHardeningLaw_h__
+#define __dnlMaterials_TabulatedHardeningLaw_h__
+
+#include <HardeningLaw.h>
+#include <vector>
+
+/*
+  \class TabulatedHardeningLaw
+  Tabulated version of any hardening law.
+
+  The wrapped hardening law is sampled once at the beginning of the computation on a regular grid over the
+  plastic strain \f$ \overline{\varepsilon^{p}} \f$, the logarithm of the plastic strain rate \f$ \ln\stackrel{\bullet}{\overline{\varepsilon^{p}}} \f$
+  and the temperature \f$ T \f$. During the computation, the yield stress and its derivatives are obtained by a trilinear
+  or a tricubic (Catmull-Rom) interpolation of the table, this is useful for the laws which are expensive to evaluate.
+  Below the minimum strain rate of the grid, the wrapped law is assumed to be independent of the strain rate.
+  Outside of the other bounds of the grid, the wrapped law is directly evaluated.
+
+  When the table is built, the interpolation errors on the yield stress and on its derivatives with respect to the
+  plastic strain, the plastic strain rate and the temperature are evaluated at the 27 points of each cell located at
+  the quarters, the center and the three quarters of the cell along each axis, and the maximum values are reported in
+  the log file. The exact derivatives are obtained by central finite differences of the wrapped law.
+
+  \ingroup dnlMaterials
+*/
+//-----------------------------------------------------------------------------
+// Class : TabulatedHardeningLaw
+//
+// Used to manage TabulatedHardeningLaw
+//
+// This class is included in SWIG
+//-----------------------------------------------------------------------------
+class TabulatedHardeningLaw : public HardeningLaw
+{
+public:
+  enum
+  {
+    Trilinear = 0,
+    Tricubic
+  };
+
+private:
+  HardeningLaw *_law = NULL;                       // Wrapped hardening law
+  int _interpolation = Tricubic;                   // Interpolation method
+  int _size[3] = {51, 21, 21};                     // Number of points of the grid along each axis
+  double _min[3] = {0.0, 0.0, 0.0};                // Minimum values of the grid along each axis
+  double _max[3] = {1.0, 0.0, 0.0};                // Maximum values of the grid along each axis
+  double _step[3] = {0.0, 0.0, 0.0};               // Steps of the grid along each axis
+  double _maxError = 0.0;                          // Maximum interpolation error on the yield stress
+  double _maxRelativeError = 0.0;                  // Maximum relative interpolation error on the yield stress
+  double _maxDerivativeError[3] = {0.0, 0.0, 0.0}; // Maximum interpolation errors on the derivatives of the yield stress
+  double _maxDerivative[3] = {0.0, 0.0, 0.0};      // Maximum absolute values of the derivatives of the yield stress
+  std::vector<double> _table;                      // Yield stress table with one ghost layer around the grid
+
+public:
+  TabulatedHardeningLaw(HardeningLaw *law = NULL);
+  TabulatedHardeningLaw(const TabulatedHardeningLaw &law);
+  ~TabulatedHardeningLaw();
+
+  // Interface methods excluded from SWIG
+#ifndef SWIG
+  double getYieldStressAndDerivative(double &hardening, double plasticStrain, double plasticStrainRate, double T, double dtime, IntegrationPoint *intPoint = NULL);
+  void initSolve(LogFile &logFile);
+#endif
+
+  // Interface methods excluded from basic SWIG support
+#if !defined(SWIG) || defined(CSWIG)
+#endif
+
+  bool isBuilt();
+  double &getParameter(int parameter);
+  double getDerivateYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
+  double getMaxDerivativeError(int axis);
+  double getMaxError();
+  double getMaxRelativeError();
+  double getYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
+  HardeningLaw *getLaw();
+  const char *getParameterName(int parameter);
+  int getNumberOfParameters();
+  void build();
+  void setGrid(double plasticStrainMax, int plasticStrainPoints, double plasticStrainRateMin, double plasticStrainRateMax, int plasticStrainRatePoints, double Tmin, double Tmax, int Tpoints);
+  void setInterpolation(int interpolation);
+  void setLaw(HardeningLaw *law);
+
+private:
+  double interpolate(double *derivatives, double plasticStrain, double logPlasticStrainRate, double T);
+  template <int nodes>
+  double tensorProduct(double *derivatives, double weights[3][4], double derWeights[3][4], const double *origin);
+  double &tableValue(int i, int j, int k);
+};
+
+//-----------------------------------------------------------------------------
+inline double &TabulatedHardeningLaw::tableValue(int i, int j, int k)
+//-----------------------------------------------------------------------------
+{
+  return _table[((i + 1) * (_size[1] + 2) + j + 1) * (_size[2] + 2) + k + 1];
+}
+
+#endif
@@ -0,0 +1,122 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+#ifndef __dnlMaterials_VumatBlock_h__
+#define __dnlMaterials_VumatBlock_h__
+
+#include <ReturnMapping.h>
+
+class Material;
+
+/*
+  \class VumatBlock
+  Block of integration points for a VUMAT-like material interface.
+
+  All the integration points sharing the same material are gathered in this structure, and the hardening law
+  updates all of them in a single call to HardeningLaw::computeVumat(), as an Abaqus/Explicit VUMAT subroutine does.
+  The arrays are stored column-major as in Fortran, so that the component \f$ k \f$ of the point \f$ i \f$ is stored at
+  index \f$ k \times nblock + i \f$, and the tensors are stored in the Abaqus order 11, 22, 33, 12, 23, 31 with the
+  tensorial shear components. The state variables of the points are stored in stateOld and stateNew with the columns
+  defined by the enum of the class.
+
+  The pressure given by the equation of state is not part of the Abaqus interface, it is given in the pressureNew array
+  and must be added to the deviatoric stress computed by the material.
+
+  \ingroup dnlMaterials
+*/
+//-----------------------------------------------------------------------------
+// Class : VumatBlock
+//
+// Used to manage a block of integration points for a VUMAT-like material interface
+//
+// This class is excluded from SWIG
+//-----------------------------------------------------------------------------
+#if !defined(SWIG)
+class VumatBlock
+{
+public:
+  // Columns of the state variables arrays
+  enum
+  {
+    statePlasticStrain = 0,
+    statePlasticStrainRate,
+    stateYieldStress,
+    stateGamma,
+    stateGammaCumulate,
+    stateHardening,
+    stateIterations,
+    stateBissections,
+    statePlasticStrainTensor,
+    numberOfStateVariables = statePlasticStrainTensor + 6
+  };
+
+public:
+  long nblock = 0;                                  // Number of points of the block
+  int ndir = 3;                                     // Number of direct components of the tensors
+  int nshr = 3;                                     // Number of shear components of the tensors
+  int nstatev = numberOfStateVariables;             // Number of state variables per point
+  double stepTime = 0.0;                            // Current time
+  double totalTime = 0.0;                           // Current total time
+  double dt = 0.0;                                  // Current time step
+  double density = 0.0;                             // Density of the material
+  double heatFraction = 0.0;                        // Taylor-Quinney coefficient divided by density and heat capacity
+  double twoShearModulus = 0.0;                     // Two times the shear modulus of the material
+  long numberOfPlasticPoints = 0;                   // Number of plastic points of the last update
+  double internalWork = 0.0;                        // Internal work of the points of the block during the last update
+  double plasticWork = 0.0;                         // Plastic work of the points of the block during the last update
+  Material *material = NULL;                        // Material of the block
+  std::vector<IntegrationPoint *> integrationPoints; // Integration points of the block
+  std::vector<double> strainInc;                    // Strain increments
+  std::vector<double> stressOld;                    // Stresses at the beginning of the increment
+  std::vector<double> stressNew;                    // Stresses at the end of the increment
+  std::vector<double> stateOld;                     // State variables at the beginning of the increment
+  std::vector<double> stateNew;                     // State variables at the end of the increment
+  std::vector<double> tempOld;                      // Temperatures at the beginning of the increment
+  std::vector<double> tempNew;                      // Temperatures at the end of the increment
+  std::vector<double> enerInternOld;                // Specific internal energies at the beginning of the increment
+  std::vector<double> enerInternNew;                // Specific internal energies at the end of the increment
+  std::vector<double> enerInelasOld;                // Specific inelastic energies at the beginning of the increment
+  std::vector<double> enerInelasNew;                // Specific inelastic energies at the end of the increment
+  std::vector<double> pressureNew;                  // Pressures given by the equation of state
+  ReturnMapping returnMapping;                      // Block of plastic points for the radial return
+
+private:
+  std::vector<long> _plasticPoints; // Indexes in the block of the points of the radial return
+
+public:
+  VumatBlock();
+  ~VumatBlock();
+
+  void add(IntegrationPoint *intPoint);
+  void clear();
+  void computeRadialReturn(HardeningLaw *hardeningLaw);
+  void gather();
+  void scatter();
+  void setParameters(Material *material, double timeStep, double time);
+  double &state(std::vector<double> &states, long point, int variable);
+  double &tensor(std::vector<double> &tensors, long point, int component);
+};
+
+//-----------------------------------------------------------------------------
+inline double &VumatBlock::state(std::vector<double> &states, long point, int variable)
+//-----------------------------------------------------------------------------
+{
+  return states[variable * nblock + point];
+}
+
+//-----------------------------------------------------------------------------
+inline double &VumatBlock::tensor(std::vector<double> &tensors, long point, int component)
+//-----------------------------------------------------------------------------
+{
+  return tensors[component * nblock + point];
+}
+#endif
+
+#endif
@@ -27,6 +27,13 @@
 #include <IntegrationPoint.h>
 #include <JohnsonCookLaw.h>
 #include <Material.h>
+#include <ReturnMapping.h>
+#include <ReturnMappingStatistics.h>
 #include <TabularLaw.h>
+#include <TabulatedHardeningLaw.h>
+#include <VumatBlock.h>
+
+// Hardening laws generated by dnlANNGenerator
+#include <dnlGeneratedLaws.h>
 
 #endif
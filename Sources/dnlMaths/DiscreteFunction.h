@@ -13,6 +13,10 @@
 
 #include <List.h>
 #include <Function.h>
+#include <vector>
+#ifndef SWIG
+#include <atomic>
+#endif
 
 //-----------------------------------------------------------------------------
 // Class : coupleReal
@@ -58,14 +62,26 @@ public:
   };
 
 protected:
-  List<coupleReal *> lpoints; // List of points
-  bool Sort;                  // Boolean flage telling if the points are sorted or not
+  List<coupleReal *> lpoints;       // List of points
+  bool Sort;                        // Boolean flage telling if the points are sorted or not
+  std::vector<double> _lookupX;     // X coordinates of the points used for the interval lookup
+  std::vector<double> _lookupY;     // Y coordinates of the points used for the interval lookup
+  std::vector<double> _lookupSlope; // Slopes of the segments of the function
+  double _lookupInverseStep = 0.0;  // Inverse of the X step if the points are uniformly spaced, null otherwise
+#ifndef SWIG
+  std::atomic<bool> _lookupReady{false}; // Boolean flag telling if the interval lookup is up to date
+#endif
 
 public:
   char style;  // First style variable for the discrete function. This is useful for storing information about this feature
   char style2; // Second style variable for the discrete function. This is useful for storing information about this feature
 
 private:
+  long getInterval(double abscissa);
+  void addPoints(const std::vector<double> &abscissas, const std::vector<double> &ordinates);
+  void getCommonAbscissas(DiscreteFunction *function, long points, std::vector<double> &abscissas);
+  void getValues(const std::vector<double> &abscissas, std::vector<double> &ordinates);
+  void invalidateLookup();
   void sort();
 
 public:
@@ -76,6 +92,7 @@ public:
   // Interface methods excluded from SWIG
 #ifndef SWIG
   void print();
+  double getValueAndSlope(double, double &);
 #endif
 
   // Interface methods excluded from basic SWIG support
@@ -127,6 +144,7 @@ public:
   void numpyReadZ(std::string, std::string);
   void numpyWrite(std::string, bool = false) const;
   void numpyWriteZ(std::string, std::string, bool = false) const;
+  void prepareLookup();
   void startPointAdd(double x, double y);
   void toGnuplot(String);
 };
@@ -160,6 +178,17 @@ inline void DiscreteFunction::flush()
 //-----------------------------------------------------------------------------
 {
   lpoints.flush();
+  invalidateLookup();
+}
+
+/*
+  Mark the interval lookup as out of date, it will be rebuilt at the next evaluation of the function
+*/
+//-----------------------------------------------------------------------------
+inline void DiscreteFunction::invalidateLookup()
+//-----------------------------------------------------------------------------
+{
+  _lookupReady.store(false, std::memory_order_release);
 }
 
 /*
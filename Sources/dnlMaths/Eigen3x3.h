@@ -16,5 +16,6 @@
 int dsyevq3(double A[3][3], double Q[3][3], double w[3]); // QL with implicit shifts
 int dsyevj3(double A[3][3], double Q[3][3], double w[3]); // Jacobi
 int dsyevd3(double A[3][3], double Q[3][3], double w[3]); // Cuppen
+int dsyevj3Batch(long count, double *A[6], double *Q[9], double *w[3]); // Jacobi on a set of matrices stored as structure-of-arrays
 
 #endif
\ No newline at end of file
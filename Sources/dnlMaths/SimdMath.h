@@ -0,0 +1,119 @@
+/**********************************************************************************
+ *                                                                                *
+ *  DynELA Finite Element Code v.4.0                                              *
+ *  by Olivier PANTALE                                                            *
+ *  Olivier.Pantale@enit.fr                                                       *
+ *                                                                                *
+ *********************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*
+  \file SimdMath.h
+  Vectorized mathematical functions.
+
+  This file defines the exp, log and pow functions working on 4 packed doubles with AVX2 instructions.
+  Polynomial approximations are the ones of the Cephes library, the relative error is about 1 ulp.
+  Those functions are only defined if the code is compiled with AVX2 support (-mavx2).
+  \ingroup dnlMaths
+*/
+
+#ifndef __dnlMaths_SimdMath_h__
+#define __dnlMaths_SimdMath_h__
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+//-----------------------------------------------------------------------------
+inline __m256d dnlPolevl4(__m256d x, const double *coefs, int degree)
+//-----------------------------------------------------------------------------
+{
+  __m256d result = _mm256_set1_pd(coefs[0]);
+  for (int i = 1; i <= degree; i++)
+    result = _mm256_add_pd(_mm256_mul_pd(result, x), _mm256_set1_pd(coefs[i]));
+  return result;
+}
+
+/*
+  Exponential of 4 packed doubles.
+  Arguments are clamped to [-708, 709] so that the result is always a normal number.
+*/
+//-----------------------------------------------------------------------------
+inline __m256d dnlExp4(__m256d x)
+//-----------------------------------------------------------------------------
+{
+  static const double P[] = {1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1};
+  static const double Q[] = {3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1, 2.00000000000000000009E0};
+
+  x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-708.0)), _mm256_set1_pd(709.0));
+
+  // Express exp(x) as exp(g) * 2^n
+  __m256d fx = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634073599)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  x = _mm256_sub_pd(x, _mm256_mul_pd(fx, _mm256_set1_pd(6.93145751953125E-1)));
+  x = _mm256_sub_pd(x, _mm256_mul_pd(fx, _mm256_set1_pd(1.42860682030941723212E-6)));
+
+  // Rational approximation exp(g) = 1 + 2 g P(g^2) / (Q(g^2) - g P(g^2))
+  __m256d xx = _mm256_mul_pd(x, x);
+  __m256d px = _mm256_mul_pd(x, dnlPolevl4(xx, P, 2));
+  __m256d qx = dnlPolevl4(xx, Q, 3);
+  x = _mm256_div_pd(px, _mm256_sub_pd(qx, px));
+  x = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_add_pd(x, x));
+
+  // Build 2^n from the exponent bits
+  __m256i n = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(fx));
+  n = _mm256_slli_epi64(_mm256_add_epi64(n, _mm256_set1_epi64x(1023)), 52);
+
+  return _mm256_mul_pd(x, _mm256_castsi256_pd(n));
+}
+
+/*
+  Natural logarithm of 4 packed doubles.
+  Arguments must be strictly positive, they are clamped to the smallest normal number.
+*/
+//-----------------------------------------------------------------------------
+inline __m256d dnlLog4(__m256d x)
+//-----------------------------------------------------------------------------
+{
+  static const double P[] = {1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+                             1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0};
+  static const double Q[] = {1.0, 1.12873587189167450590E1, 4.52279145837532221105E1,
+                             8.29875266912776603211E1, 7.11544750618563894466E1, 2.31251620126765340583E1};
+
+  x = _mm256_max_pd(x, _mm256_set1_pd(2.2250738585072014e-308));
+
+  // Split x into a mantissa m in [0.5, 1[ and an exponent e
+  __m256i bits = _mm256_castpd_si256(x);
+  __m256i exponent = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x4330000000000000LL));
+  __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(exponent), _mm256_set1_pd(4503599627370496.0 + 1022.0));
+  __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                                  _mm256_set1_epi64x(0x3FE0000000000000LL)));
+
+  // If m < sqrt(1/2) use 2m - 1 and e - 1, m - 1 otherwise
+  __m256d mask = _mm256_cmp_pd(m, _mm256_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+  e = _mm256_sub_pd(e, _mm256_and_pd(mask, _mm256_set1_pd(1.0)));
+  m = _mm256_sub_pd(_mm256_add_pd(m, _mm256_and_pd(mask, m)), _mm256_set1_pd(1.0));
+
+  // Rational approximation of log(1 + m)
+  __m256d z = _mm256_mul_pd(m, m);
+  __m256d y = _mm256_div_pd(_mm256_mul_pd(_mm256_mul_pd(m, z), dnlPolevl4(m, P, 5)), dnlPolevl4(m, Q, 5));
+  y = _mm256_sub_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(2.121944400546905827679e-4)));
+  y = _mm256_sub_pd(y, _mm256_mul_pd(_mm256_set1_pd(0.5), z));
+
+  // Add the exponent part e * log(2)
+  return _mm256_add_pd(_mm256_add_pd(m, y), _mm256_mul_pd(e, _mm256_set1_pd(0.693359375)));
+}
+
+/*
+  Power x^y of 4 packed doubles for strictly positive values of x.
+*/
+//-----------------------------------------------------------------------------
+inline __m256d dnlPow4(__m256d x, __m256d y)
+//-----------------------------------------------------------------------------
+{
+  return dnlExp4(_mm256_mul_pd(y, dnlLog4(x)));
+}
+
+#endif
+
+#endif
@@ -53,6 +53,8 @@ class Tensor2
 private:
   bool indexOK(short, short) const;
   void buildFTF(double[3][3]) const;
+  void incrementalRotation(double[3], double, double);
+  void midPointIncrement(SymTensor2 &, double[3]) const;
   void polarExtract(double[3][3], double[3], SymTensor2 &, Tensor2 &) const;
   void polarExtractLnU(double[3][3], double[3], SymTensor2 &, Tensor2 &) const;
 
@@ -127,6 +129,8 @@ public:
   void numpyReadZ(std::string, std::string);
   void numpyWrite(std::string, bool = false) const;
   void numpyWriteZ(std::string, std::string, bool = false) const;
+  void hughesWinget(SymTensor2 &, Tensor2 &) const;
+  void jaumann(SymTensor2 &, Tensor2 &) const;
   void polar(SymTensor2 &, Tensor2 &) const;
   void polarQL(SymTensor2 &, Tensor2 &) const;
   void polarJacobi(SymTensor2 &, Tensor2 &) const;
@@ -137,6 +141,8 @@ public:
   void polarJacobiLnU(SymTensor2 &, Tensor2 &) const;
   void polarCuppenLnU(SymTensor2 &, Tensor2 &) const;
   void polarLapackLnU(SymTensor2 &, Tensor2 &) const;
+  bool polarSeriesLnU(SymTensor2 &, Tensor2 &) const;
+  static void polarBatchLnU(int, const Tensor2 *, SymTensor2 **, Tensor2 **);
   void setToUnity();
   void setValue(const double);
   void setToZero();
@@ -41,6 +41,13 @@ class Benchmark:
         benchRun = subprocess.run(bashCommand, shell=True, check=True)
         return benchRun.returncode
 
+    def readPlotFile(self, file):
+        # Binary history files are numpy structured arrays, one named column per item
+        if (file.endswith('.npy') or file.endswith('.npy.ref')):
+            data = np.load(file)
+            return data.view(np.float64).reshape(len(data), -1)
+        return np.genfromtxt(file)
+
     def runCompare(self):
         diff = False
         shutil.copy2(iconsDir + '/run-flag.png', '_bench.png')
@@ -49,8 +56,8 @@ class Benchmark:
             print("Success\n")
             for file in self.files:
                 try:
-                    data1 = np.genfromtxt(file)
-                    data0 = np.genfromtxt(file + '.ref')
+                    data1 = self.readPlotFile(file)
+                    data0 = self.readPlotFile(file + '.ref')
                     if ((np.abs(data1-data0)).max() > self.tolerance):
                         print("Found differences in result file " +file+"\n")
                         print("  Delta is " + str((np.abs(data1-data0)).max())+"\n")
@@ -60,6 +60,15 @@ class Curves:
 
     def readPlotFile(self, filename, column_1 = 0, column_2 = 1):
         x, y = [], []
+        # Binary history files are numpy structured arrays, one named column per item
+        if (filename.endswith('.npy')):
+            try:
+                data = numpy.load(filename)
+            except:
+                print("Datafile:", filename, "not exists -> Ignored\n")
+                return '', x, y
+            names = data.dtype.names
+            return names[1], list(data[names[column_1]]), list(data[names[column_2]])
         try:
             f = open(filename)
         except: